@@ -0,0 +1,122 @@
+// Copyright [2026-10-19] <agent@local, agent>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "text_processor/text_processor.h"
+
+namespace {
+
+size_t NumArcs(const fst::StdVectorFst& vfst) {
+  size_t num_arcs = 0;
+  for (fst::StateIterator<fst::StdVectorFst> state_iter(vfst);
+       !state_iter.Done(); state_iter.Next()) {
+    num_arcs += vfst.NumArcs(state_iter.Value());
+  }
+  return num_arcs;
+}
+
+double SecondsSince(
+    const std::chrono::time_point<std::chrono::steady_clock>& time_start) {
+  return std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - time_start).count();
+}
+
+}  // namespace
+
+// Compares doing the character mappings of PRE_NORMALIZER in the C++
+// PreNormalizer against doing them inside the tagger, i.e., TAGGER vs.
+// TAGGER_WITH_CHAR_MAP (exported by taggers/tagger_with_char_map.grm).
+int main(int argc, char *argv[]) {
+  if (argc != 4 && argc != 5) {
+    std::cout << WENET_RED("[Usage]: ./pre_normalizer_bench_main")
+              << WENET_RED(" tagger.fst tagger_with_char_map.fst")
+              << WENET_RED(" pre_normalizer.fst [num_repeats]")
+              << WENET_RED(" < input.txt")
+              << std::endl;
+    return 0;
+  }
+  int num_repeats = argc == 5 ? std::stoi(argv[4]) : 10;
+  std::vector<std::string> lines;
+  size_t num_bytes = 0;
+  std::string input;
+  while (std::getline(std::cin, input)) {
+    num_bytes += input.size();
+    lines.emplace_back(input);
+  }
+  if (lines.empty() || num_repeats <= 0) {
+    std::cout << WENET_RED("no input lines to benchmark.") << std::endl;
+    return 0;
+  }
+
+  wenet::TextProcessor helper("", "");
+  std::unique_ptr<wenet::PreNormalizer> pre_normalizer(
+      helper.ReadPreNormalizer(argv[3]));
+  std::unique_ptr<fst::StdVectorFst> tagger(fst::StdVectorFst::Read(argv[1]));
+  std::unique_ptr<fst::StdVectorFst> baked_tagger(
+      fst::StdVectorFst::Read(argv[2]));
+  if (pre_normalizer == nullptr || tagger == nullptr ||
+      baked_tagger == nullptr) {
+    std::cout << WENET_RED("read tagger or pre_normalizer fst failed.")
+              << std::endl;
+    return 0;
+  }
+  fst::ArcSort(tagger.get(), fst::ILabelCompare<fst::StdArc>());
+  fst::ArcSort(baked_tagger.get(), fst::ILabelCompare<fst::StdArc>());
+
+  // stage-1: throughput of PreNormalizer
+  size_t num_output_bytes = 0;
+  std::chrono::time_point<std::chrono::steady_clock> time_start =
+    std::chrono::steady_clock::now();
+  for (int r = 0; r < num_repeats; ++r) {
+    for (const auto& line : lines) {
+      num_output_bytes += pre_normalizer->Normalize(line).size();
+    }
+  }
+  double seconds = SecondsSince(time_start);
+  std::cout << "pre_normalizer: " << lines.size() << " lines, "
+            << num_bytes << " bytes x " << num_repeats << " repeats, "
+            << seconds * 1000 << "ms, "
+            << num_bytes * num_repeats / seconds / (1 << 20) << " MB/s"
+            << " (" << num_output_bytes << " bytes output)" << std::endl;
+
+  // stage-2: size of tagger with and without the mappings baked in
+  std::cout << "tagger        : " << tagger->NumStates() << " states, "
+            << NumArcs(*tagger) << " arcs" << std::endl
+            << "baked tagger  : " << baked_tagger->NumStates() << " states, "
+            << NumArcs(*baked_tagger) << " arcs" << std::endl;
+
+  // stage-3: time of pre_normalizer + compose(input, tagger) vs.
+  //          compose(input, baked_tagger), outputs should be the same
+  fst::StringCompiler<fst::StdArc> str_compiler(fst::StringTokenType::BYTE);
+  fst::ComposeOptions opts(true, fst::ALT_SEQUENCE_FILTER);
+  double pre_normalized_seconds = 0.0, baked_seconds = 0.0;
+  size_t num_mismatches = 0;
+  for (int r = 0; r < num_repeats; ++r) {
+    for (const auto& line : lines) {
+      fst::StdVectorFst input_fst, tagged_lattice;
+      std::string tagged_text, baked_tagged_text;
+      time_start = std::chrono::steady_clock::now();
+      str_compiler(pre_normalizer->Normalize(line), &input_fst);
+      helper.FormatFst(&input_fst);
+      fst::Compose(input_fst, *tagger, &tagged_lattice, opts);
+      pre_normalized_seconds += SecondsSince(time_start);
+      helper.FstToString(tagged_lattice, &tagged_text);
+
+      time_start = std::chrono::steady_clock::now();
+      str_compiler(line, &input_fst);
+      helper.FormatFst(&input_fst);
+      fst::Compose(input_fst, *baked_tagger, &tagged_lattice, opts);
+      baked_seconds += SecondsSince(time_start);
+      helper.FstToString(tagged_lattice, &baked_tagged_text);
+      if (r == 0 && tagged_text != baked_tagged_text) ++num_mismatches;
+    }
+  }
+  std::cout << "compose time  : pre_normalizer + tagger "
+            << pre_normalized_seconds * 1000 << "ms, baked tagger "
+            << baked_seconds * 1000 << "ms" << std::endl
+            << "mismatches    : " << num_mismatches << " / " << lines.size()
+            << std::endl;
+  return 0;
+}
@@ -3,17 +3,19 @@
 #include "text_processor/text_processor.h"
 
 int main(int argc, char *argv[]) {
-  if (argc != 4) {
+  if (argc != 4 && argc != 5) {
     std::cout << WENET_RED("[Usage]: ./text_process_main")
-              << WENET_RED(" tagger.fst verbalizer.fst 1")
+              << WENET_RED(" tagger.fst verbalizer.fst 1 [pre_normalizer.fst]")
               << std::endl;
     return 0;
   }
   std::string tagger_fst_path = argv[1];
   std::string verbalizer_fst_path = argv[2];
   bool verbose = std::stoi(argv[3]);
+  std::string pre_normalizer_fst_path = argc == 5 ? argv[4] : "";
   wenet::TextProcessor text_processor(tagger_fst_path,
-                                      verbalizer_fst_path);
+                                      verbalizer_fst_path,
+                                      pre_normalizer_fst_path);
   std::string input;
   std::cout << "Start Processing Text (verbose = "
             << verbose << "):" << std::endl << std::endl;
@@ -0,0 +1,153 @@
+// Copyright [2026-10-19] <agent@local, agent>
+
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "text_processor/pre_normalizer.h"
+#include "utils/colors.h"
+
+namespace {
+
+using Mappings = std::vector<std::pair<std::string, std::string>>;
+
+int num_failures = 0;
+
+void Check(bool ok, const std::string& what, const std::string& input) {
+  if (ok) return;
+  ++num_failures;
+  std::cout << WENET_RED("FAILED: ") << what << ", input bytes:";
+  for (unsigned char c : input) std::cout << " " << static_cast<int>(c);
+  std::cout << std::endl;
+}
+
+std::string Utf8(uint32_t cp) {
+  std::string s;
+  if (cp < 0x80) {
+    s.push_back(cp);
+  } else if (cp < 0x800) {
+    s.push_back(0xc0 | (cp >> 6));
+    s.push_back(0x80 | (cp & 0x3f));
+  } else {
+    s.push_back(0xe0 | (cp >> 12));
+    s.push_back(0x80 | ((cp >> 6) & 0x3f));
+    s.push_back(0x80 | (cp & 0x3f));
+  }
+  return s;
+}
+
+// The same mappings as PRE_NORMALIZER of the en grammars, see
+// grammars/common/char_map.grm and en/taggers/pre_normalizer.grm.
+Mappings EnMappings() {
+  Mappings mappings;
+  for (uint32_t cp = 0xff01; cp <= 0xff5e; ++cp) {
+    char c = cp - 0xfee0;
+    if (c >= 'A' && c <= 'Z') c += 'a' - 'A';
+    mappings.emplace_back(Utf8(cp), std::string(1, c));
+  }
+  for (uint32_t cp : {0x09, 0x0a, 0x0d, 0xa0, 0x2002, 0x2003, 0x2004, 0x2005,
+                      0x2006, 0x2007, 0x2008, 0x2009, 0x200a, 0x202f,
+                      0x3000}) {
+    mappings.emplace_back(Utf8(cp), " ");
+  }
+  for (char c = 'A'; c <= 'Z'; ++c) {
+    mappings.emplace_back(std::string(1, c), std::string(1, c + 'a' - 'A'));
+  }
+  return mappings;
+}
+
+// Byte level leftmost rewrite, i.e., what CDRewrite[PRE_NORMALIZER, "", "",
+// b.kBytes*] does to the input, mapped chars never overlap.
+std::string Rewrite(const Mappings& mappings, const std::string& input) {
+  std::string output;
+  size_t i = 0;
+  while (i < input.size()) {
+    bool mapped = false;
+    for (const auto& mapping : mappings) {
+      if (input.compare(i, mapping.first.size(), mapping.first) == 0) {
+        output += mapping.second;
+        i += mapping.first.size();
+        mapped = true;
+        break;
+      }
+    }
+    if (!mapped) output.push_back(input[i++]);
+  }
+  return output;
+}
+
+void TestExamples() {
+  wenet::PreNormalizer pre_normalizer(EnMappings());
+  const std::vector<std::pair<std::string, std::string>> examples = {
+    {"", ""},
+    {"twenty three pounds", "twenty three pounds"},
+    {"ＴＨＥ　ｐｒｉｃｅ is ｔｗｅｎｔｙ　ＰＯＵＮＤＳ",
+     "the price is twenty pounds"},
+    {"the code is １２３，and\xc2\xa0the room\tis Four",
+     "the code is 123,and the room is four"},
+    {"一共有十七分之七的观众", "一共有十七分之七的观众"},
+    // truncated or malformed multi-byte sequences are copied byte by byte,
+    // the chars right after them are still mapped.
+    {"\xe3\xaf\xef\xbd\x85", "\xe3\xaf" "e"},
+    {"\xc2\x41", "\xc2" "a"},
+    {"today \xe3\x80 may \xef\xbd", "today \xe3\x80 may \xef\xbd"},
+  };
+  for (bool use_simd : {true, false}) {
+    wenet::PreNormalizer tested(EnMappings(), use_simd);
+    for (const auto& example : examples) {
+      Check(tested.Normalize(example.first) == example.second,
+            use_simd ? "example (simd)" : "example (scalar)", example.first);
+    }
+  }
+  Check(pre_normalizer.NumMappings() == EnMappings().size(),
+        "number of mappings", "");
+}
+
+// Random inputs mixing mapped chars, unmapped chars and stray bytes, checked
+// against Rewrite on both the SIMD and the scalar path.
+void TestRandom(const Mappings& mappings, const std::vector<uint32_t>& chars,
+                int num_inputs, uint32_t seed) {
+  wenet::PreNormalizer simd(mappings, true);
+  wenet::PreNormalizer scalar(mappings, false);
+  const std::string stray = "\xc2\xe3\xef\xe2\xe4\xbd\x80\xa0\x85";
+  std::mt19937 rng(seed);
+  for (int n = 0; n < num_inputs; ++n) {
+    std::string input;
+    int length = rng() % 64;
+    for (int k = 0; k < length; ++k) {
+      switch (rng() % 3) {
+        case 0: input += mappings[rng() % mappings.size()].first; break;
+        case 1: input += Utf8(chars[rng() % chars.size()]); break;
+        default: input.push_back(stray[rng() % stray.size()]); break;
+      }
+    }
+    std::string expected = Rewrite(mappings, input);
+    Check(simd.Normalize(input) == expected, "random (simd)", input);
+    Check(scalar.Normalize(input) == expected, "random (scalar)", input);
+  }
+}
+
+}  // namespace
+
+int main() {
+  TestExamples();
+  TestRandom(EnMappings(), {'a', 'z', ' ', '1', 0x4e00, 0x8c6a, 0x20ac},
+             100000, 1);
+  // More than 8 distinct nibble classes, some of them get merged.
+  Mappings many;
+  for (uint32_t cp : {0x01, 0x12, 0x23, 0x34, 0x45, 0x56, 0x67, 0x78, 0xc0,
+                      0x100, 0x4e8c, 0x5341, 0x6587, 0x7f51, 0x9a6c}) {
+    many.emplace_back(Utf8(cp), "#");
+  }
+  TestRandom(many, {'a', 'z', 0x4e00, 0x4e8d, 0x8c6a, 0xa1}, 100000, 2);
+  if (num_failures > 0) {
+    std::cout << WENET_RED(num_failures) << WENET_RED(" checks failed.")
+              << std::endl;
+    return 1;
+  }
+  std::cout << "all pre_normalizer checks passed." << std::endl;
+  return 0;
+}
@@ -0,0 +1,221 @@
+// Copyright [2026-10-19] <agent@local, agent>
+
+#include "text_processor/pre_normalizer.h"
+
+#include <algorithm>
+#include <iostream>
+
+#include "utils/colors.h"
+
+// Only SkipUnmappedSsse3 is compiled with target("ssse3"), the rest of the
+// library keeps the default flags and the cpu is checked at runtime.
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define WENET_PRE_NORMALIZER_SSSE3
+#include <tmmintrin.h>
+#elif defined(__aarch64__)
+#define WENET_PRE_NORMALIZER_NEON
+#include <arm_neon.h>
+#endif
+
+namespace wenet {
+
+namespace {
+
+// Length of the UTF-8 char starting with lead byte c, 0 if c can not start
+// a char (i.e., continuation bytes or invalid bytes).
+inline size_t Utf8Length(unsigned char c) {
+  if (c < 0x80) return 1;
+  if ((c & 0xe0) == 0xc0) return 2;
+  if ((c & 0xf0) == 0xe0) return 3;
+  if ((c & 0xf8) == 0xf0) return 4;
+  return 0;
+}
+
+inline uint32_t PackUtf8(const char* data, size_t length) {
+  uint32_t key = 0;
+  for (size_t i = 0; i < length; ++i) {
+    key = (key << 8) | static_cast<unsigned char>(data[i]);
+  }
+  return key;
+}
+
+#if defined(WENET_PRE_NORMALIZER_SSSE3)
+// Scans data[0, size) 16 bytes at a time, returns the offset of the first
+// flagged byte and sets *found, or the offset the scalar tail starts from.
+__attribute__((target("ssse3")))
+size_t SkipUnmappedSsse3(const uint8_t* lo_nibble, const uint8_t* hi_nibble,
+                         const char* data, size_t size, bool* found) {
+  const __m128i lo_table =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(lo_nibble));
+  const __m128i hi_table =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(hi_nibble));
+  const __m128i nibble_mask = _mm_set1_epi8(0x0f);
+  const __m128i zero = _mm_setzero_si128();
+  size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    __m128i bytes =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    __m128i lo = _mm_shuffle_epi8(lo_table, _mm_and_si128(bytes, nibble_mask));
+    __m128i hi = _mm_shuffle_epi8(
+        hi_table, _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble_mask));
+    __m128i hit = _mm_cmpeq_epi8(_mm_and_si128(lo, hi), zero);
+    int mask = _mm_movemask_epi8(hit) ^ 0xffff;
+    if (mask != 0) {
+      *found = true;
+      return i + __builtin_ctz(mask);
+    }
+  }
+  *found = false;
+  return i;
+}
+
+inline bool CpuSupportsSimd() { return __builtin_cpu_supports("ssse3"); }
+#elif defined(WENET_PRE_NORMALIZER_NEON)
+size_t SkipUnmappedNeon(const uint8_t* lo_nibble, const uint8_t* hi_nibble,
+                        const char* data, size_t size, bool* found) {
+  const uint8x16_t lo_table = vld1q_u8(lo_nibble);
+  const uint8x16_t hi_table = vld1q_u8(hi_nibble);
+  const uint8x16_t nibble_mask = vdupq_n_u8(0x0f);
+  size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    uint8x16_t bytes = vld1q_u8(reinterpret_cast<const uint8_t*>(data + i));
+    uint8x16_t lo = vqtbl1q_u8(lo_table, vandq_u8(bytes, nibble_mask));
+    uint8x16_t hi = vqtbl1q_u8(hi_table, vshrq_n_u8(bytes, 4));
+    uint8x16_t hit = vtstq_u8(lo, hi);
+    // Narrow each 0x00/0xff byte of hit to 4 bits of a 64 bits mask.
+    uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(
+        vreinterpretq_u16_u8(hit), 4)), 0);
+    if (mask != 0) {
+      *found = true;
+      return i + (__builtin_ctzll(mask) >> 2);
+    }
+  }
+  *found = false;
+  return i;
+}
+
+inline bool CpuSupportsSimd() { return true; }
+#else
+inline bool CpuSupportsSimd() { return false; }
+#endif
+
+}  // namespace
+
+PreNormalizer::PreNormalizer(
+    const std::vector<std::pair<std::string, std::string>>& mappings,
+    bool use_simd) : use_simd_(use_simd && CpuSupportsSimd()) {
+  for (const auto& mapping : mappings) {
+    AddMapping(mapping.first, mapping.second);
+  }
+  BuildScanTables();
+}
+
+void PreNormalizer::AddMapping(const std::string& from,
+                               const std::string& to) {
+  if (from.empty() || Utf8Length(from[0]) != from.size()) {
+    std::cout << WENET_YELLOW(WENET_HEADER)
+              << WENET_YELLOW("pre_normalizer only maps single chars, ")
+              << WENET_YELLOW("skip mapping from: ") << from << std::endl;
+    return;
+  }
+  if (from == to) return;
+  std::string* target = nullptr;
+  if (from.size() == 1) {
+    unsigned char c = static_cast<unsigned char>(from[0]);
+    if (!maybe_mapped_[c]) target = &ascii_map_[c];
+  } else {
+    uint32_t key = PackUtf8(from.data(), from.size());
+    if (utf8_map_.find(key) == utf8_map_.end()) target = &utf8_map_[key];
+  }
+  if (target == nullptr) {
+    std::cout << WENET_YELLOW(WENET_HEADER)
+              << WENET_YELLOW("ambiguous pre_normalizer mapping, ")
+              << WENET_YELLOW("keep the first one for: ") << from << std::endl;
+    return;
+  }
+  *target = to;
+  maybe_mapped_[static_cast<unsigned char>(from[0])] = true;
+  ++num_mappings_;
+}
+
+void PreNormalizer::BuildScanTables() {
+  // High nibbles whose sets of mapped low nibbles are the same share one of
+  // the 8 bits of the tables. Mapped bytes are only ascii or lead bytes, so
+  // there are rarely more than 8 distinct sets, if so the extra ones are
+  // merged into the last bit, which may flag a few unmapped bytes (handled
+  // and copied as is by the scalar path) but never misses a mapped one.
+  std::vector<uint16_t> classes;
+  for (int h = 0; h < 16; ++h) {
+    uint16_t low_set = 0;
+    for (int l = 0; l < 16; ++l) {
+      if (maybe_mapped_[(h << 4) | l]) low_set |= 1 << l;
+    }
+    if (low_set == 0) continue;
+    size_t bit = std::find(classes.begin(), classes.end(), low_set) -
+                 classes.begin();
+    if (bit == classes.size()) classes.push_back(low_set);
+    bit = std::min<size_t>(bit, 7);
+    hi_nibble_[h] = 1 << bit;
+    for (int l = 0; l < 16; ++l) {
+      if (low_set & (1 << l)) lo_nibble_[l] |= 1 << bit;
+    }
+  }
+}
+
+size_t PreNormalizer::SkipUnmapped(const char* data, size_t size) const {
+  size_t i = 0;
+#if defined(WENET_PRE_NORMALIZER_SSSE3) || defined(WENET_PRE_NORMALIZER_NEON)
+  if (use_simd_) {
+    bool found = false;
+#if defined(WENET_PRE_NORMALIZER_SSSE3)
+    i = SkipUnmappedSsse3(lo_nibble_, hi_nibble_, data, size, &found);
+#else
+    i = SkipUnmappedNeon(lo_nibble_, hi_nibble_, data, size, &found);
+#endif
+    if (found) return i;
+  }
+#endif
+  for (; i < size; ++i) {
+    if (maybe_mapped_[static_cast<unsigned char>(data[i])]) return i;
+  }
+  return size;
+}
+
+std::string PreNormalizer::Normalize(const std::string& input) const {
+  if (num_mappings_ == 0) return input;
+  std::string output;
+  output.reserve(input.size());
+  const char* data = input.data();
+  const size_t size = input.size();
+  size_t i = 0;
+  while (i < size) {
+    size_t length = SkipUnmapped(data + i, size - i);
+    output.append(data + i, length);
+    i += length;
+    if (i == size) break;
+    unsigned char c = static_cast<unsigned char>(data[i]);
+    length = maybe_mapped_[c] ? Utf8Length(c) : 0;
+    if (length == 1) {
+      output.append(ascii_map_[c]);
+      i += 1;
+      continue;
+    }
+    if (length > 1 && i + length <= size) {
+      // keys are valid UTF-8, so a hit also checks the continuation bytes.
+      auto iter = utf8_map_.find(PackUtf8(data + i, length));
+      if (iter != utf8_map_.end()) {
+        output.append(iter->second);
+        i += length;
+        continue;
+      }
+    }
+    // false positive of SkipUnmapped, unmapped or malformed char, copy only
+    // this byte so that a mapped char right after it is still found, i.e.,
+    // E3 AF EF BD 85 ==> E3 AF 65, the same as PRE_NORMALIZER_REWRITE.
+    output.push_back(data[i]);
+    i += 1;
+  }
+  return output;
+}
+
+}  // namespace wenet
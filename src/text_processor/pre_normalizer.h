@@ -0,0 +1,58 @@
+// Copyright [2026-10-19] <agent@local, agent>
+
+#ifndef TEXT_PROCESSOR_PRE_NORMALIZER_H_
+#define TEXT_PROCESSOR_PRE_NORMALIZER_H_
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace wenet {
+
+// PreNormalizer applies simple character mappings (full-width to half-width,
+// whitespace folding, case folding, ...) to the input before it is composed
+// with the tagger. Doing them here instead of CDRewrite[..., b.kBytes*] in the
+// grammars keeps the tagger smaller and saves arcs on every input byte.
+//
+// Each mapping takes exactly one UTF-8 character to an output string, they are
+// read from the PRE_NORMALIZER fst exported by the grammars (i.e.,
+// grammars/inverse_text_normalization/en/taggers/pre_normalizer.grm) by
+// TextProcessor::ReadPreNormalizer.
+//
+// Unmapped bytes are skipped 16 at a time with SSSE3 (if the cpu supports it)
+// or NEON table lookups, only bytes that may start a mapped character fall
+// back to the scalar path. use_simd = false forces the scalar path.
+class PreNormalizer {
+ public:
+  explicit PreNormalizer(
+      const std::vector<std::pair<std::string, std::string>>& mappings,
+      bool use_simd = true);
+  std::string Normalize(const std::string& input) const;
+  size_t NumMappings() const { return num_mappings_; }
+
+ private:
+  void AddMapping(const std::string& from, const std::string& to);
+  void BuildScanTables();
+  // Returns the number of leading bytes of data[0, size) that can be copied
+  // verbatim, the byte right after them (if any) may start a mapped char.
+  size_t SkipUnmapped(const char* data, size_t size) const;
+
+  bool use_simd_ = false;
+  size_t num_mappings_ = 0;
+  // ascii_map_[c] is the replacement of ascii char c, empty if unmapped.
+  std::vector<std::string> ascii_map_ = std::vector<std::string>(128);
+  // key is the raw bytes of a multi-byte UTF-8 char packed into uint32.
+  std::unordered_map<uint32_t, std::string> utf8_map_;
+  // maybe_mapped_[b] is true if byte b is the first byte of a mapped char.
+  bool maybe_mapped_[256] = {false};
+  // Nibble lookup tables used by SkipUnmapped, byte b may be mapped only if
+  // (lo_nibble_[b & 0xf] & hi_nibble_[b >> 4]) != 0, see BuildScanTables.
+  uint8_t lo_nibble_[16] = {0};
+  uint8_t hi_nibble_[16] = {0};
+};
+
+}  // namespace wenet
+
+#endif  // TEXT_PROCESSOR_PRE_NORMALIZER_H_
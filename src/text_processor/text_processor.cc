@@ -4,14 +4,41 @@
 
 namespace wenet {
 
+namespace {
+
+// Collects the (input, output) strings of all paths of an acyclic fst.
+void CollectPaths(const fst::StdVectorFst& vfst, fst::StdArc::StateId state,
+                  std::string* from, std::string* to,
+                  std::vector<std::pair<std::string, std::string>>* paths) {
+  if (vfst.Final(state) != fst::StdArc::Weight::Zero()) {
+    paths->emplace_back(*from, *to);
+  }
+  for (fst::ArcIterator<fst::StdVectorFst> arc_iter(vfst, state);
+       !arc_iter.Done(); arc_iter.Next()) {
+    const fst::StdArc& arc = arc_iter.Value();
+    size_t from_size = from->size(), to_size = to->size();
+    if (arc.ilabel != 0) from->push_back(arc.ilabel);
+    if (arc.olabel != 0) to->push_back(arc.olabel);
+    CollectPaths(vfst, arc.nextstate, from, to, paths);
+    from->resize(from_size);
+    to->resize(to_size);
+  }
+}
+
+}  // namespace
+
 TextProcessor::TextProcessor(const std::string& tagger_fst_path,
-                             const std::string& verbalizer_fst_path) {
+                             const std::string& verbalizer_fst_path,
+                             const std::string& pre_normalizer_fst_path) {
   if (!tagger_fst_path.empty()) {
     tagger_fst_.reset(SortInputLabels(tagger_fst_path));
   }
   if (!verbalizer_fst_path.empty()) {
     verbalizer_fst_.reset(SortInputLabels(verbalizer_fst_path));
   }
+  if (!pre_normalizer_fst_path.empty()) {
+    pre_normalizer_.reset(ReadPreNormalizer(pre_normalizer_fst_path));
+  }
   str_compiler_ = std::make_shared<fst::StringCompiler<fst::StdArc>>(
       fst::StringTokenType::BYTE);
 }
@@ -25,6 +52,28 @@ fst::StdVectorFst* TextProcessor::SortInputLabels(const std::string& fst_path) {
   return sorted_fst;
 }
 
+PreNormalizer* TextProcessor::ReadPreNormalizer(const std::string& fst_path) {
+  std::unique_ptr<fst::StdVectorFst> mapping_fst(
+      fst::StdVectorFst::Read(fst_path));
+  if (mapping_fst == nullptr || mapping_fst->Start() == fst::kNoStateId ||
+      !mapping_fst->Properties(fst::kAcyclic, true)) {
+    std::cout << WENET_YELLOW(WENET_HEADER)
+              << WENET_YELLOW("read pre_normalizer fst failed or it is ")
+              << WENET_YELLOW("empty/cyclic, skip pre_normalizer.")
+              << std::endl;
+    return nullptr;
+  }
+  // Each path of the mapping fst is a pair of strings, the labels are bytes
+  // since the grammars are compiled in byte mode.
+  std::vector<std::pair<std::string, std::string>> mappings;
+  std::string from, to;
+  CollectPaths(*mapping_fst, mapping_fst->Start(), &from, &to, &mappings);
+  PreNormalizer* pre_normalizer = new PreNormalizer(mappings);
+  std::cout << WENET_HEADER << "Loaded " << pre_normalizer->NumMappings()
+            << " pre_normalizer mappings from " << fst_path << std::endl;
+  return pre_normalizer;
+}
+
 void TextProcessor::FormatFst(fst::StdVectorFst* vfst) {
   for (fst::StateIterator<fst::StdVectorFst> state_iter(*vfst);
        !state_iter.Done(); state_iter.Next()) {
@@ -50,10 +99,25 @@ std::string TextProcessor::ProcessInput(const std::string& input,
               << WENET_YELLOW("will do nothing for input.") << std::endl;
     return input;
   }
+  // stage-0: pre_normalizer, map chars like full-width digits or punctuations
+  //          before tagging, details in text_processor/pre_normalizer.h
+  std::string normalized_input = input;
+  if (pre_normalizer_ != nullptr) {
+    normalized_input = pre_normalizer_->Normalize(input);
+    if (verbose) {
+      std::cout << "pre_normalized: " << normalized_input << std::endl
+                << "pre_normalizer time cost: "
+                << std::chrono::duration_cast<std::chrono::microseconds>(
+                     std::chrono::steady_clock::now() - time_start).count()
+                << "us" << std::endl;
+    }
+    time_start = std::chrono::steady_clock::now();
+  }
+
   // stage-1: tagger
   //   stage-1.1: construct input_fst from input string
   fst::StdVectorFst input_fst, tagged_lattice;
-  if (!str_compiler_->operator()(input, &input_fst)) {
+  if (!str_compiler_->operator()(normalized_input, &input_fst)) {
     std::cout << WENET_YELLOW(WENET_HEADER)
               << WENET_YELLOW("compile input to input_fst failed, ")
               << WENET_YELLOW("will do nothing for input.") << std::endl;
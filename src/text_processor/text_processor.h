@@ -11,6 +11,7 @@
 #include <unordered_map>
 
 #include "fst/fstlib.h"
+#include "text_processor/pre_normalizer.h"
 #include "utils/paths.h"
 #include "utils/colors.h"
 
@@ -33,8 +34,10 @@ struct Token {
 class TextProcessor {
  public:
   TextProcessor(const std::string& tagger_fst_path,
-                const std::string& verbalizer_fst_path);
+                const std::string& verbalizer_fst_path,
+                const std::string& pre_normalizer_fst_path = "");
   fst::StdVectorFst* SortInputLabels(const std::string& fst_path);
+  PreNormalizer* ReadPreNormalizer(const std::string& fst_path);
   void FormatFst(fst::StdVectorFst* fst);
   std::string ProcessInput(const std::string& input, bool verbose);
   bool ParseAndReorder(const std::string& tagged_text,
@@ -44,6 +47,7 @@ class TextProcessor {
 
  private:
   std::shared_ptr<fst::StringCompiler<fst::StdArc>> str_compiler_ = nullptr;
+  std::shared_ptr<PreNormalizer> pre_normalizer_ = nullptr;
   std::shared_ptr<fst::StdVectorFst> tagger_fst_ = nullptr;
   std::shared_ptr<fst::StdVectorFst> verbalizer_fst_ = nullptr;
   std::unordered_map<std::string,